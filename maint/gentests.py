@@ -49,6 +49,24 @@ def gen_simple_tests(testlist):
     outfile.write(os.path.join(prefix, "threaded_test") + "\n")
     outfile.write(os.path.join(prefix, "lbub") + "\n")
     outfile.write(os.path.join(prefix, "test_contig") + "\n")
+    outfile.write(os.path.join(prefix, "pup_threads") + "\n")
+    outfile.write(os.path.join(prefix, "iov_offset") + "\n")
+    outfile.write(os.path.join(prefix, "blkhindx_runs") + "\n")
+    outfile.write(os.path.join(prefix, "maxloc") + "\n")
+    outfile.write(os.path.join(prefix, "half_reduce") + "\n")
+    outfile.write(os.path.join(prefix, "blkcpy") + "\n")
+    outfile.write(os.path.join(prefix, "nt_copy") + "\n")
+    outfile.write(os.path.join(prefix, "deep_nesting") + "\n")
+    outfile.write(os.path.join(prefix, "jit") + "\n")
+    outfile.write(os.path.join(prefix, "type_cache") + "\n")
+    outfile.write(os.path.join(prefix, "many_handles") + "\n")
+    outfile.write(os.path.join(prefix, "host_pack") + "\n")
+    outfile.write(os.path.join(prefix, "buffer_pool") + "\n")
+    outfile.write(os.path.join(prefix, "async_pup") + "\n")
+    outfile.write(os.path.join(prefix, "host_stream") + "\n")
+    outfile.write(os.path.join(prefix, "request_waitall") + "\n")
+    outfile.write(os.path.join(prefix, "request_notify") + "\n")
+    outfile.write(os.path.join(prefix, "gpu_progress") + "\n")
     outfile.close()
     sys.stdout.write("done\n")
 
@@ -145,10 +163,13 @@ if __name__ == '__main__':
                        " -num-threads 4")
     gen_pack_iov_tests("pack", "test/pack/testlist.blocking.gen", True, \
                        " -blocking")
+    gen_pack_iov_tests("pack", "test/pack/testlist.cursor.gen", True, \
+                       " -cursor")
     gen_pack_iov_tests("pack", "test/pack/testlist.stream.gen", True, \
                        " -stream")
 
     gen_pack_iov_tests("iov", "test/iov/testlist.gen", False)
     gen_pack_iov_tests("iov", "test/iov/testlist.threads.gen", False, " -num-threads 4")
+    gen_pack_iov_tests("iov", "test/iov/testlist.iter.gen", False, " -iov-iter")
     gen_flatten_tests("test/flatten/testlist.gen")
     gen_flatten_tests("test/flatten/testlist.threads.gen", " -num-threads 4")
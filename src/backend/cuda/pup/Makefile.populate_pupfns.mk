@@ -0,0 +1,43 @@
+##
+## Copyright (C) by Argonne National Laboratory
+##     See COPYRIGHT in top-level directory
+##
+## DO NOT EDIT: AUTOMATICALLY GENERATED FILE !!
+##
+
+libyaksa_la_SOURCES += \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hvector_hvector.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hvector_blkhindx.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hvector_hindexed.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hvector_contig.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hvector_resized.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hvector_builtin.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_blkhindx_hvector.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_blkhindx_blkhindx.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_blkhindx_hindexed.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_blkhindx_contig.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_blkhindx_resized.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_blkhindx_builtin.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hindexed_hvector.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hindexed_blkhindx.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hindexed_hindexed.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hindexed_contig.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hindexed_resized.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_hindexed_builtin.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_contig_hvector.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_contig_blkhindx.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_contig_hindexed.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_contig_contig.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_contig_resized.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_contig_builtin.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_resized_hvector.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_resized_blkhindx.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_resized_hindexed.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_resized_contig.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_resized_resized.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_resized_builtin.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns_builtin.c \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns.c
+
+noinst_HEADERS += \
+	src/backend/cuda/pup/yaksuri_cudai_populate_pupfns.h
@@ -24,7 +24,15 @@ type_ops = {'_Bool': {'REPLACE', 'LAND', 'LOR', 'LXOR'},
             'c_complex': {'REPLACE', 'SUM', 'PROD'},
             'c_double_complex': {'REPLACE', 'SUM', 'PROD'},
             'c_long_double_complex': {'REPLACE', 'SUM', 'PROD'},
-            'long double': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX'}}
+            'long double': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX'},
+            'float16': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX'},
+            'bfloat16': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX'},
+            'float_int': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX', 'MAXLOC', 'MINLOC'},
+            'double_int': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX', 'MAXLOC', 'MINLOC'},
+            'long_int': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX', 'LAND', 'LOR', 'LXOR', 'BAND', 'BOR', 'BXOR', 'MAXLOC', 'MINLOC'},
+            'short_int': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX', 'LAND', 'LOR', 'LXOR', 'BAND', 'BOR', 'BXOR', 'MAXLOC', 'MINLOC'},
+            'long_double_int': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX', 'MAXLOC', 'MINLOC'},
+            '2int': {'REPLACE', 'SUM', 'PROD', 'MIN', 'MAX', 'LAND', 'LOR', 'LXOR', 'BAND', 'BOR', 'BXOR', 'MAXLOC', 'MINLOC'}}
 ########################################################################################
 ##### Switch statement generation for pup function selection
 ########################################################################################
@@ -214,13 +222,7 @@ def populate_pupfns(pup_max_nesting, backend, blklens, builtin_types, builtin_ma
                     yutils.display(OUTFILE, "yaksuri_%si_type_s *%s = (yaksuri_%si_type_s *) type->backend.%s.priv;\n" \
                                    % (backend, backend, backend, backend))
                     yutils.display(OUTFILE, "\n")
-                    yutils.display(OUTFILE, "char *str = getenv(\"YAKSA_ENV_MAX_NESTING_LEVEL\");\n")
-                    yutils.display(OUTFILE, "int max_nesting_level;\n")
-                    yutils.display(OUTFILE, "if (str) {\n")
-                    yutils.display(OUTFILE, "max_nesting_level = atoi(str);\n")
-                    yutils.display(OUTFILE, "} else {\n")
-                    yutils.display(OUTFILE, "max_nesting_level = YAKSI_ENV_DEFAULT_NESTING_LEVEL;\n")
-                    yutils.display(OUTFILE, "}\n")
+                    yutils.display(OUTFILE, "int max_nesting_level = yaksi_global.max_nesting_level;\n")
                     yutils.display(OUTFILE, "\n")
 
                     pupstr = "%s_%s" % (dtype1, dtype2)
@@ -249,13 +251,7 @@ def populate_pupfns(pup_max_nesting, backend, blklens, builtin_types, builtin_ma
             yutils.display(OUTFILE, "yaksuri_%si_type_s *%s = (yaksuri_%si_type_s *) type->backend.%s.priv;\n" \
                            % (backend, backend, backend, backend))
             yutils.display(OUTFILE, "\n")
-            yutils.display(OUTFILE, "char *str = getenv(\"YAKSA_ENV_MAX_NESTING_LEVEL\");\n")
-            yutils.display(OUTFILE, "int max_nesting_level;\n")
-            yutils.display(OUTFILE, "if (str) {\n")
-            yutils.display(OUTFILE, "max_nesting_level = atoi(str);\n")
-            yutils.display(OUTFILE, "} else {\n")
-            yutils.display(OUTFILE, "max_nesting_level = YAKSI_ENV_DEFAULT_NESTING_LEVEL;\n")
-            yutils.display(OUTFILE, "}\n")
+            yutils.display(OUTFILE, "int max_nesting_level = yaksi_global.max_nesting_level;\n")
             yutils.display(OUTFILE, "\n")
 
             pupstr = "%s" % dtype1
@@ -319,6 +315,8 @@ def populate_pupfns(pup_max_nesting, backend, blklens, builtin_types, builtin_ma
     yutils.display(OUTFILE, "#ifndef YAKSURI_%sI_POPULATE_PUPFNS_H_INCLUDED\n" % backend.upper())
     yutils.display(OUTFILE, "#define YAKSURI_%sI_POPULATE_PUPFNS_H_INCLUDED\n" % backend.upper())
     yutils.display(OUTFILE, "\n")
+    yutils.display(OUTFILE, "#define YAKSURI_%sI_PUP_MAX_NESTING  (%d)\n" % (backend.upper(), pup_max_nesting))
+    yutils.display(OUTFILE, "\n")
     if pup_max_nesting > 0:
         for dtype1 in derived_types:
             if pup_max_nesting > 1:
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) by Argonne National Laboratory
+ *     See COPYRIGHT in top-level directory
+ *
+ * DO NOT EDIT: AUTOMATICALLY GENERATED FILE !!
+ */
+
+#ifndef YAKSURI_HIPI_POPULATE_PUPFNS_H_INCLUDED
+#define YAKSURI_HIPI_POPULATE_PUPFNS_H_INCLUDED
+
+#define YAKSURI_HIPI_PUP_MAX_NESTING  (3)
+
+int yaksuri_hipi_populate_pupfns_hvector_hvector(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hvector_blkhindx(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hvector_hindexed(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hvector_contig(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hvector_resized(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hvector_builtin(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_blkhindx_hvector(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_blkhindx_blkhindx(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_blkhindx_hindexed(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_blkhindx_contig(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_blkhindx_resized(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_blkhindx_builtin(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hindexed_hvector(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hindexed_blkhindx(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hindexed_hindexed(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hindexed_contig(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hindexed_resized(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_hindexed_builtin(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_contig_hvector(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_contig_blkhindx(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_contig_hindexed(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_contig_contig(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_contig_resized(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_contig_builtin(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_resized_hvector(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_resized_blkhindx(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_resized_hindexed(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_resized_contig(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_resized_resized(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_resized_builtin(yaksi_type_s * type);
+int yaksuri_hipi_populate_pupfns_builtin(yaksi_type_s * type);
+
+#endif  /* YAKSURI_HIPI_POPULATE_PUPFNS_H_INCLUDED */